@@ -0,0 +1,23 @@
+#include "bench.hpp"
+
+using namespace type_list;
+
+// BENCH_SIZE distinct calls of each of the _t aliases that take the alias
+// fast path. All calls push onto the same list, which is the best case for
+// the alias fast path. Compare the peak memory of the compiler with and
+// without -DTYPELIST_NO_ALIAS_API.
+using small_list = TypeList<int, char, double, long>;
+
+template <size_t I> using pushed = push_back_t<bench::element<I>, small_list>;
+
+template <size_t... Is>
+TypeList<TypeList<pushed<Is>, push_front_t<bench::element<Is>, small_list>,
+                  head_t<pushed<Is> >, tail_t<pushed<Is> >,
+                  pop_front_t<pushed<Is> > >...>
+calls(std::index_sequence<Is...>);
+
+using result = decltype(calls(std::make_index_sequence<BENCH_SIZE>{}));
+
+static_assert(list_size<result>::value == BENCH_SIZE, "");
+
+int main() { return 0; }
@@ -0,0 +1,20 @@
+#include "bench.hpp"
+
+using namespace type_list;
+
+// The common case for the alias fast path: every call takes a different list,
+// so the per-list helpers are not shared between calls. Compare with
+// alias_api, where all calls push onto the same list.
+template <size_t I> using small_list = TypeList<int, bench::element<I> >;
+
+template <size_t... Is>
+TypeList<TypeList<push_front_t<char, small_list<Is> >,
+                  push_back_t<char, small_list<Is> >,
+                  pop_front_t<small_list<Is> > >...>
+calls(std::index_sequence<Is...>);
+
+using result = decltype(calls(std::make_index_sequence<BENCH_SIZE>{}));
+
+static_assert(list_size<result>::value == BENCH_SIZE, "");
+
+int main() { return 0; }
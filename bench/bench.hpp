@@ -0,0 +1,31 @@
+#ifndef TYPE_LIST_BENCH_HPP
+#define TYPE_LIST_BENCH_HPP
+
+#include "type_list/type_list.hpp"
+
+#include <utility>
+
+#ifndef BENCH_SIZE
+#define BENCH_SIZE 1000
+#endif
+
+namespace bench {
+template <size_t I> struct element {};
+
+template <class Seq> struct make_list;
+
+template <size_t... Is> struct make_list<std::index_sequence<Is...> > {
+  using type = type_list::TypeList<element<Is>...>;
+};
+
+/// @brief a TypeList of BENCH_SIZE distinct elements.
+using list = typename make_list<std::make_index_sequence<BENCH_SIZE> >::type;
+
+template <class T> struct is_odd;
+
+template <size_t I> struct is_odd<element<I> > {
+  static constexpr bool value = I % 2 == 1;
+};
+} // namespace bench
+
+#endif
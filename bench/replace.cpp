@@ -0,0 +1,27 @@
+#include "bench.hpp"
+
+using namespace type_list;
+
+template <size_t... Is>
+TypeList<typename std::conditional<Is == BENCH_SIZE / 2, void,
+                                   bench::element<Is> >::type...>
+expected_replace(std::index_sequence<Is...>);
+
+template <size_t... Is>
+TypeList<typename std::conditional<Is % 2 == 1, void,
+                                   bench::element<Is> >::type...>
+expected_replace_if(std::index_sequence<Is...>);
+
+using replaced = replace_t<bench::element<BENCH_SIZE / 2>, void, bench::list>;
+using replaced_if = replace_if_t<bench::is_odd, void, bench::list>;
+
+static_assert(
+    std::is_same<replaced, decltype(expected_replace(
+                               std::make_index_sequence<BENCH_SIZE>{}))>::value,
+    "");
+static_assert(std::is_same<replaced_if,
+                           decltype(expected_replace_if(
+                               std::make_index_sequence<BENCH_SIZE>{}))>::value,
+              "");
+
+int main() { return 0; }
@@ -0,0 +1,12 @@
+#include "bench.hpp"
+
+using namespace type_list;
+
+using reversed = reverse_t<bench::list>;
+
+static_assert(list_size<reversed>::value == BENCH_SIZE, "");
+static_assert(std::is_same<head_t<reversed>, bench::element<BENCH_SIZE - 1> >::value,
+              "");
+static_assert(std::is_same<reverse_t<reversed>, bench::list>::value, "");
+
+int main() { return 0; }
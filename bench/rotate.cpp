@@ -0,0 +1,14 @@
+#include "bench.hpp"
+
+using namespace type_list;
+
+using rotated = rotate_t<BENCH_SIZE / 3, bench::list>;
+
+static_assert(list_size<rotated>::value == BENCH_SIZE, "");
+static_assert(std::is_same<head_t<rotated>, bench::element<BENCH_SIZE / 3> >::value,
+              "");
+static_assert(std::is_same<rotate_t<BENCH_SIZE - BENCH_SIZE / 3, rotated>,
+                           bench::list>::value,
+              "");
+
+int main() { return 0; }
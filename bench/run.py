@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+"""Compile time scaling benchmarks.
+
+Compiles every bench/*.cpp once per list size and prints the wall clock time
+and the peak resident set size of the compiler.
+
+usage: bench/run.py [sizes...]
+environment: CXX (default c++), CXXFLAGS (default -std=c++14),
+             BENCH (space separated benchmark names, default all)
+"""
+
+import os
+import shlex
+import subprocess
+import sys
+import time
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+
+
+def compile_once(cxx, flags, src, size):
+    cmd = [cxx, *flags, f"-I{ROOT / 'include'}", f"-DBENCH_SIZE={size}",
+           "-fsyntax-only", str(src)]
+    start = time.monotonic()
+    proc = subprocess.Popen(cmd)
+    _, status, usage = os.wait4(proc.pid, 0)
+    seconds = time.monotonic() - start
+    if os.waitstatus_to_exitcode(status) != 0:
+        sys.exit(f"compilation failed: {shlex.join(cmd)}")
+    return seconds, usage.ru_maxrss
+
+
+def main():
+    cxx = os.environ.get("CXX", "c++")
+    flags = shlex.split(os.environ.get("CXXFLAGS", "-std=c++14"))
+    sizes = [int(s) for s in sys.argv[1:]] or [125, 250, 500, 1000, 2000]
+    names = os.environ.get("BENCH", "").split()
+    print(f"{'benchmark':<21} {'size':>6} {'seconds':>8} {'peak_rss_kib':>13}")
+    for src in sorted((ROOT / "bench").glob("*.cpp")):
+        if names and src.stem not in names:
+            continue
+        for size in sizes:
+            seconds, rss = compile_once(cxx, flags, src, size)
+            print(f"{src.stem:<21} {size:>6} {seconds:>8.2f} {rss:>13}",
+                  flush=True)
+
+
+if __name__ == "__main__":
+    main()
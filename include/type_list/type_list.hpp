@@ -19,6 +19,16 @@
 #define TYPELIST_INLINE static
 #endif
 
+// From C++17 onwards push_front_t and push_back_t are computed through a helper
+// that is instantiated once per list instead of once per call, and pop_front_t
+// shares tail's instantiation. This only saves compile time and memory when
+// many different types are pushed onto the same list. When every call takes a
+// different list it costs slightly more. Define TYPELIST_NO_ALIAS_API to always
+// use the meta function structs.
+#if __cplusplus >= 201703L && !defined(TYPELIST_NO_ALIAS_API)
+#define TYPELIST_ALIAS_API
+#endif
+
 namespace type_list {
 
 /// @brief constant for indicating an invalid index.
@@ -109,6 +119,26 @@ template <template <class...> class List1, template <class...> class List2,
 struct filter_impl<List1<Filtered...>, List2<>, Predicate> {
   using type = List2<Filtered...>;
 };
+
+#ifdef TYPELIST_ALIAS_API
+// Instantiated once per list. Pushing different types onto the same list only
+// adds alias template specializations. push_front and push_back are separate
+// helpers so a push_front never names List<Ts..., T>, which is ill-formed for
+// list templates that are not variadic.
+template <class List> struct list_push_front;
+
+template <template <class...> class List, class... Ts>
+struct list_push_front<List<Ts...> > {
+  template <class T> using type = TypeList<T, Ts...>;
+};
+
+template <class List> struct list_push_back;
+
+template <template <class...> class List, class... Ts>
+struct list_push_back<List<Ts...> > {
+  template <class T> using type = List<Ts..., T>;
+};
+#endif
 } // namespace
 
 /**
@@ -189,8 +219,13 @@ struct push_front<T, List<Ts...> > {
  * @tparam T the type to add
  * @tparam List a type list
  */
+#ifdef TYPELIST_ALIAS_API
+template <class T, class List>
+using push_front_t = typename list_push_front<List>::template type<T>;
+#else
 template <class T, class List>
 using push_front_t = typename push_front<T, List>::type;
+#endif
 
 /**
  * @brief returns List with the first element removed. If List is empty, 
@@ -213,7 +248,12 @@ template <template <class...> class List> struct pop_front<List<> > {
  * an empty List is returned.
  * @tparam List a type list
  */
+#ifdef TYPELIST_ALIAS_API
+// pop_front and tail are the same operation, share tail's instantiation.
+template <class List> using pop_front_t = typename tail<List>::type;
+#else
 template <class List> using pop_front_t = typename pop_front<List>::type;
+#endif
 
 /**
  * @brief returns N-th type in type_list List.
@@ -276,8 +316,13 @@ struct push_back<T, List<Ts...> > {
  * @tparam T the element
  * @tparam List a type list
  */
+#ifdef TYPELIST_ALIAS_API
+template <class T, class List>
+using push_back_t = typename list_push_back<List>::template type<T>;
+#else
 template <class T, class List>
 using push_back_t = typename push_back<T, List>::type;
+#endif
 
 namespace {
 template <class List, size_t I> struct pop_back_impl;
@@ -501,6 +546,387 @@ struct remove_duplicates : remove_duplicates_impl<TypeList<>, List> {};
 template <class List>
 using remove_duplicates_t = typename remove_duplicates<List>::type;
 
+namespace {
+template <size_t... Is> struct index_sequence_impl {};
+
+template <class Seq1, class Seq2> struct concat_sequence_impl;
+
+template <size_t... I1, size_t... I2>
+struct concat_sequence_impl<index_sequence_impl<I1...>,
+                            index_sequence_impl<I2...> > {
+  using type = index_sequence_impl<I1..., (sizeof...(I1) + I2)...>;
+};
+
+// halves N on every step, so the instantiation depth is O(log N).
+template <size_t N>
+struct make_index_sequence_helper
+    : concat_sequence_impl<
+          typename make_index_sequence_helper<N / 2>::type,
+          typename make_index_sequence_helper<N - N / 2>::type> {};
+
+template <> struct make_index_sequence_helper<0> {
+  using type = index_sequence_impl<>;
+};
+
+template <> struct make_index_sequence_helper<1> {
+  using type = index_sequence_impl<0>;
+};
+
+template <size_t N>
+using make_index_sequence_impl = typename make_index_sequence_helper<N>::type;
+
+#if defined(__has_builtin)
+#if __has_builtin(__type_pack_element)
+#define TYPELIST_HAS_TYPE_PACK_ELEMENT
+#endif
+#endif
+
+template <class List, class Seq> struct reverse_impl;
+
+template <size_t N, class List, class Seq> struct rotate_impl;
+
+template <size_t N, template <class...> class List>
+struct rotate_impl<N, List<>, index_sequence_impl<> > {
+  using type = List<>;
+};
+
+#ifdef TYPELIST_HAS_TYPE_PACK_ELEMENT
+template <template <class...> class List, class... Ts, size_t... Is>
+struct reverse_impl<List<Ts...>, index_sequence_impl<Is...> > {
+  using type = List<__type_pack_element<sizeof...(Ts) - 1 - Is, Ts...>...>;
+};
+
+template <size_t N, template <class...> class List, class... Ts, size_t... Is>
+struct rotate_impl<N, List<Ts...>, index_sequence_impl<Is...> > {
+  using type = List<__type_pack_element<(Is + N) % sizeof...(Ts), Ts...>...>;
+};
+#else
+template <class T> struct box {};
+
+template <size_t I> struct index_placeholder {
+  using pointer = const void *;
+  using list = TypeList<>;
+};
+
+template <class Seq> struct split_impl;
+
+// only used in unevaluated context. The leading parameters swallow one element
+// each and Rest is deduced from the remaining ones, which is O(N) work at a
+// constant instantiation depth. Static member functions are used so that
+// argument dependent lookup cannot pick up functions from the namespaces of
+// the elements.
+template <size_t... Is> struct split_impl<index_sequence_impl<Is...> > {
+  template <class... Rest>
+  static TypeList<Rest...>
+  drop(typename index_placeholder<Is>::pointer..., box<Rest> *...);
+
+  // drops the same elements as drop and appends as many empty lists.
+  template <class... Rest>
+  static TypeList<Rest..., typename index_placeholder<Is>::list...>
+  shift(typename index_placeholder<Is>::pointer..., box<Rest> *...);
+};
+
+template <class List1, class List2> struct join_impl;
+
+template <class... Ts, class... Us>
+struct join_impl<TypeList<Ts...>, TypeList<Us...> > {
+  using type = TypeList<Ts..., Us...>;
+};
+
+template <bool Keep, bool Swap, class List1, class List2>
+struct join_step_impl {
+  using type = TypeList<>;
+};
+
+template <class List1, class List2>
+struct join_step_impl<true, false, List1, List2> : join_impl<List1, List2> {};
+
+template <class List1, class List2>
+struct join_step_impl<true, true, List1, List2> : join_impl<List2, List1> {};
+
+template <class Lists> struct join_result_impl {
+  using type = TypeList<>;
+};
+
+template <class List, class... Lists>
+struct join_result_impl<TypeList<List, Lists...> > {
+  using type = List;
+};
+
+// concatenates a TypeList of TypeLists. Every round joins the lists at i and
+// i + Stride for every i that is a multiple of 2 * Stride and then doubles
+// Stride, so the first list holds the result after O(log N) rounds of O(N)
+// work each. With Swap every join is swapped, which reverses the order of the
+// lists.
+template <bool Swap, size_t Stride, class Seq, class Lists>
+struct join_tree_impl;
+
+template <bool Swap, size_t Stride, class Seq, class Lists>
+struct join_round_impl;
+
+template <bool Swap, size_t Stride, class Seq, class Lists, class Shifted>
+struct join_zip_impl;
+
+template <bool Swap, size_t Stride, size_t... Is, class... Lists>
+struct join_tree_impl<Swap, Stride, index_sequence_impl<Is...>,
+                      TypeList<Lists...> >
+    : std::conditional<(Stride >= sizeof...(Lists)),
+                       join_result_impl<TypeList<Lists...> >,
+                       join_round_impl<Swap, Stride, index_sequence_impl<Is...>,
+                                       TypeList<Lists...> > >::type {};
+
+template <bool Swap, size_t Stride, size_t... Is, class... Lists>
+struct join_round_impl<Swap, Stride, index_sequence_impl<Is...>,
+                       TypeList<Lists...> >
+    : join_zip_impl<
+          Swap, Stride, index_sequence_impl<Is...>, TypeList<Lists...>,
+          decltype(split_impl<make_index_sequence_impl<Stride> >::shift(
+              static_cast<box<Lists> *>(nullptr)...))> {};
+
+template <bool Swap, size_t Stride, size_t... Is, class... Lists,
+          class... Shifted>
+struct join_zip_impl<Swap, Stride, index_sequence_impl<Is...>,
+                     TypeList<Lists...>, TypeList<Shifted...> >
+    : join_tree_impl<Swap, Stride * 2, index_sequence_impl<Is...>,
+                     TypeList<typename join_step_impl<
+                         Is % (2 * Stride) == 0, Swap, Lists,
+                         Shifted>::type...> > {};
+
+// joining the one element lists in swapped order splits the list into halves
+// recursively and swaps them.
+template <template <class...> class List, class... Ts, size_t... Is>
+struct reverse_impl<List<Ts...>, index_sequence_impl<Is...> >
+    : apply<List, typename join_tree_impl<true, 1, index_sequence_impl<Is...>,
+                                          TypeList<TypeList<Ts>...> >::type> {
+};
+
+template <size_t N, class Seq, class... Ts> struct take_impl;
+
+template <size_t N, size_t... Is, class... Ts>
+struct take_impl<N, index_sequence_impl<Is...>, Ts...>
+    : join_tree_impl<false, 1, index_sequence_impl<Is...>,
+                     TypeList<typename std::conditional<
+                         (Is < N), TypeList<Ts>, TypeList<> >::type...> > {};
+
+// splits at N % sizeof...(Ts) and joins the two parts in swapped order.
+template <size_t N, template <class...> class List, class... Ts, size_t... Is>
+struct rotate_impl<N, List<Ts...>, index_sequence_impl<Is...> >
+    : apply<List,
+            typename join_impl<
+                decltype(split_impl<
+                         make_index_sequence_impl<N % sizeof...(Ts)> >::drop(
+                    static_cast<box<Ts> *>(nullptr)...)),
+                typename take_impl<N % sizeof...(Ts),
+                                   index_sequence_impl<Is...>,
+                                   Ts...>::type>::type> {};
+#endif
+} // namespace
+
+/**
+ * @brief returns List with its elements in reverse order.
+ * @note The instantiation depth is O(log N) in the size of List.
+ * @tparam List a type list
+ */
+template <class List> struct reverse;
+
+template <template <class...> class List, class... Ts>
+struct reverse<List<Ts...> >
+    : reverse_impl<List<Ts...>, make_index_sequence_impl<sizeof...(Ts)> > {};
+
+/**
+ * @brief returns List with its elements in reverse order.
+ * @note The instantiation depth is O(log N) in the size of List.
+ * @tparam List a type list
+ */
+template <class List> using reverse_t = typename reverse<List>::type;
+
+/**
+ * @brief returns List rotated left by N, i.e. the element at index
+ * N % list_size<List>::value becomes the first element. Rotating an empty List
+ * returns an empty List.
+ * @note The instantiation depth is O(log N) in the size of List.
+ * @tparam N the number of positions to rotate by
+ * @tparam List a type list
+ */
+template <size_t N, class List> struct rotate;
+
+template <size_t N, template <class...> class List, class... Ts>
+struct rotate<N, List<Ts...> >
+    : rotate_impl<N, List<Ts...>, make_index_sequence_impl<sizeof...(Ts)> > {};
+
+/**
+ * @brief returns List rotated left by N, i.e. the element at index
+ * N % list_size<List>::value becomes the first element. Rotating an empty List
+ * returns an empty List.
+ * @note The instantiation depth is O(log N) in the size of List.
+ * @tparam N the number of positions to rotate by
+ * @tparam List a type list
+ */
+template <size_t N, class List>
+using rotate_t = typename rotate<N, List>::type;
+
+/**
+ * @brief returns List with every occurrence of Old replaced by New.
+ * @tparam Old the type to replace
+ * @tparam New the replacement type
+ * @tparam List a type list
+ */
+template <class Old, class New, class List> struct replace;
+
+template <class Old, class New, template <class...> class List, class... Ts>
+struct replace<Old, New, List<Ts...> > {
+  using type = List<typename std::conditional<std::is_same<Old, Ts>::value,
+                                              New, Ts>::type...>;
+};
+
+/**
+ * @brief returns List with every occurrence of Old replaced by New.
+ * @tparam Old the type to replace
+ * @tparam New the replacement type
+ * @tparam List a type list
+ */
+template <class Old, class New, class List>
+using replace_t = typename replace<Old, New, List>::type;
+
+/**
+ * @brief returns List with every element T for which Predicate<T>::value is
+ * true replaced by New.
+ * @tparam Predicate a meta function returning true or false
+ * @tparam New the replacement type
+ * @tparam List a type list
+ */
+template <template <class> class Predicate, class New, class List>
+struct replace_if;
+
+template <template <class> class Predicate, class New,
+          template <class...> class List, class... Ts>
+struct replace_if<Predicate, New, List<Ts...> > {
+  using type =
+      List<typename std::conditional<Predicate<Ts>::value, New, Ts>::type...>;
+};
+
+/**
+ * @brief returns List with every element T for which Predicate<T>::value is
+ * true replaced by New.
+ * @tparam Predicate a meta function returning true or false
+ * @tparam New the replacement type
+ * @tparam List a type list
+ */
+template <template <class> class Predicate, class New, class List>
+using replace_if_t = typename replace_if<Predicate, New, List>::type;
+
+/**
+ * @brief runtime layout facts about a single type, as stored in
+ * type_info_table.
+ */
+struct type_info_entry {
+  /// @brief sizeof(T)
+  size_t size;
+  /// @brief alignof(T)
+  size_t alignment;
+  /// @brief the name of T as spelled by the compiler, not null terminated.
+  const char *name;
+  /// @brief the number of characters in name.
+  size_t name_size;
+  /// @brief std::is_trivially_copyable<T>::value
+  bool trivially_copyable;
+  /// @brief std::is_trivially_destructible<T>::value
+  bool trivially_destructible;
+};
+
+// Named rather than unnamed: type_info_table<...>::value has external linkage,
+// so its initializer has to refer to the same entities in every TU.
+namespace detail {
+struct signature_string {
+  const char *data;
+  size_t size;
+};
+
+template <class T> constexpr signature_string signature() {
+#if defined(_MSC_VER) && !defined(__clang__)
+  return signature_string{__FUNCSIG__, sizeof(__FUNCSIG__) - 1};
+#else
+  return signature_string{__PRETTY_FUNCTION__,
+                          sizeof(__PRETTY_FUNCTION__) - 1};
+#endif
+}
+
+constexpr bool starts_with(const char *str, const char *prefix) {
+  return *prefix == '\0' ||
+         (*str == *prefix && starts_with(str + 1, prefix + 1));
+}
+
+constexpr size_t find_in(const char *str, const char *what, size_t pos = 0) {
+  return str[pos] == '\0'             ? npos
+         : starts_with(str + pos, what) ? pos
+                                        : find_in(str, what, pos + 1);
+}
+
+// The signature of signature<double>() is used to measure the text the
+// compiler places around the type name.
+constexpr size_t name_prefix_size() {
+  return find_in(signature<double>().data, "double");
+}
+
+constexpr size_t name_suffix_size() {
+  return signature<double>().size - name_prefix_size() - (sizeof("double") - 1);
+}
+
+template <class T> constexpr type_info_entry make_type_info_entry() {
+  return type_info_entry{sizeof(T),
+                         alignof(T),
+                         signature<T>().data + name_prefix_size(),
+                         signature<T>().size - name_prefix_size() -
+                             name_suffix_size(),
+                         std::is_trivially_copyable<T>::value,
+                         std::is_trivially_destructible<T>::value};
+}
+} // namespace detail
+
+/**
+ * @brief a compile time table of type_info_entry records, one for each element
+ * of List, in order.
+ *
+ * The table is a static constexpr array and is therefore built entirely at
+ * compile time. Index it with index_of, i.e.
+ * ``type_info_table<List>::value[index_of<T, List>::value]``.
+ * An empty List has no value array, but begin() and end() form a valid
+ * (empty) range for every List, so generic code can iterate with
+ * ``for (const type_info_entry &e : type_info_table<List>{})``.
+ *
+ * @tparam List a type list of complete object types
+ */
+template <class List> struct type_info_table;
+
+template <template <class...> class List, class... Ts>
+struct type_info_table<List<Ts...> > {
+  static constexpr size_t size = sizeof...(Ts);
+  static constexpr type_info_entry value[] = {
+      detail::make_type_info_entry<Ts>()...};
+
+  static constexpr const type_info_entry *begin() { return value; }
+  static constexpr const type_info_entry *end() { return value + size; }
+};
+
+template <template <class...> class List>
+struct type_info_table<List<> > {
+  static constexpr size_t size = 0;
+
+  static constexpr const type_info_entry *begin() { return nullptr; }
+  static constexpr const type_info_entry *end() { return nullptr; }
+};
+
+#if __cplusplus < 201703L
+template <template <class...> class List, class... Ts>
+constexpr size_t type_info_table<List<Ts...> >::size;
+
+template <template <class...> class List, class... Ts>
+constexpr type_info_entry type_info_table<List<Ts...> >::value[];
+
+template <template <class...> class List>
+constexpr size_t type_info_table<List<> >::size;
+#endif
+
 #if __cplusplus >= 201402L
 template <class List>
 TYPELIST_INLINE constexpr size_t list_size_v = list_size<List>::value;
@@ -1,5 +1,7 @@
 #include "type_list/type_list.hpp"
 
+#include <utility>
+
 using namespace type_list;
 
 // clang-format off
@@ -180,6 +182,152 @@ static_assert(remove_duplicates_t<TypeList<int, int, char, double, char, int,
                                            double, char> >() ==
                   TypeList<int, char, double>(),
               "");
+
+static_assert(reverse_t<TypeList<> >{} == TypeList<>{}, "");
+static_assert(reverse_t<TypeList<int> >{} == TypeList<int>{}, "");
+static_assert(reverse_t<TypeList<int, char> >{} == TypeList<char, int>{}, "");
+static_assert(reverse_t<TypeList<int, char, int, double> >{} ==
+                  TypeList<double, int, char, int>{},
+              "");
+static_assert(std::is_same<reverse_t<other_list<int, char> >,
+                           other_list<char, int> >::value,
+              "");
+
+namespace user {
+struct A {};
+struct B {};
+// must not be found by argument dependent lookup inside reverse / rotate.
+template <size_t I, class T> int select(T);
+template <size_t I, class T> int at(T);
+} // namespace user
+
+static_assert(reverse_t<TypeList<user::A, user::B> >{} ==
+                  TypeList<user::B, user::A>{},
+              "");
+static_assert(rotate_t<1, TypeList<user::A, user::B> >{} ==
+                  TypeList<user::B, user::A>{},
+              "");
+
+static_assert(rotate_t<0, TypeList<> >{} == TypeList<>{}, "");
+static_assert(rotate_t<3, TypeList<> >{} == TypeList<>{}, "");
+static_assert(rotate_t<0, TypeList<int, char, double> >{} ==
+                  TypeList<int, char, double>{},
+              "");
+static_assert(rotate_t<1, TypeList<int, char, double> >{} ==
+                  TypeList<char, double, int>{},
+              "");
+static_assert(rotate_t<2, TypeList<int, char, double> >{} ==
+                  TypeList<double, int, char>{},
+              "");
+static_assert(rotate_t<4, TypeList<int, char, double> >{} ==
+                  TypeList<char, double, int>{},
+              "");
+static_assert(std::is_same<rotate_t<1, other_list<int, char> >,
+                           other_list<char, int> >::value,
+              "");
+
+static_assert(replace_t<int, long, TypeList<> >{} == TypeList<>{}, "");
+static_assert(replace_t<int, long, TypeList<char> >{} == TypeList<char>{}, "");
+static_assert(replace_t<int, long, TypeList<int, char, int> >{} ==
+                  TypeList<long, char, long>{},
+              "");
+static_assert(std::is_same<replace_t<int, long, other_list<int, char> >,
+                           other_list<long, char> >::value,
+              "");
+
+static_assert(replace_if_t<std::is_signed, void, TypeList<> >{} == TypeList<>{},
+              "");
+static_assert(replace_if_t<std::is_signed, void,
+                           TypeList<unsigned, int, long, unsigned char> >{} ==
+                  TypeList<unsigned, void, void, unsigned char>{},
+              "");
+static_assert(std::is_same<replace_if_t<std::is_signed, void, other_list<int> >,
+                           other_list<void> >::value,
+              "");
+
+// head_t / first_t never name the tail and push_front_t never names the list
+// template with an extra argument, so they also work for list templates
+// that are not variadic.
+static_assert(std::is_same<head_t<std::pair<int, char> >, int>::value, "");
+static_assert(std::is_same<first_t<std::pair<int, char> >, int>::value, "");
+static_assert(std::is_same<push_front_t<int, std::pair<int, char> >,
+                           TypeList<int, int, char> >::value,
+              "");
+static_assert(std::is_same<head<TypeList<int, char> >::type,
+                           head_t<TypeList<int, char> > >::value,
+              "");
+static_assert(std::is_same<tail<other_list<int, char> >::type,
+                           tail_t<other_list<int, char> > >::value,
+              "");
+static_assert(std::is_same<pop_front<other_list<> >::type,
+                           pop_front_t<other_list<> > >::value,
+              "");
+static_assert(std::is_same<push_front<int, other_list<char> >::type,
+                           push_front_t<int, other_list<char> > >::value,
+              "");
+static_assert(std::is_same<push_back<int, other_list<char> >::type,
+                           push_back_t<int, other_list<char> > >::value,
+              "");
+
+struct NonTrivial {
+  NonTrivial(const NonTrivial &) {}
+  ~NonTrivial() {}
+};
+
+constexpr bool name_equals(const char *name, size_t size, const char *str) {
+  return size == 0 ? *str == '\0'
+                   : *name == *str && name_equals(name + 1, size - 1, str + 1);
+}
+
+using InfoList = TypeList<char, double, NonTrivial>;
+
+static_assert(type_info_table<TypeList<> >::size == 0, "");
+static_assert(type_info_table<TypeList<> >::begin() ==
+                  type_info_table<TypeList<> >::end(),
+              "");
+static_assert(type_info_table<InfoList>::end() -
+                      type_info_table<InfoList>::begin() ==
+                  3,
+              "");
+static_assert(type_info_table<InfoList>::size == 3, "");
+static_assert(type_info_table<other_list<int> >::size == 1, "");
+static_assert(type_info_table<InfoList>::value[0].size == sizeof(char), "");
+static_assert(type_info_table<InfoList>::value[1].size == sizeof(double), "");
+static_assert(type_info_table<InfoList>::value[1].alignment == alignof(double),
+              "");
+static_assert(type_info_table<InfoList>::value[index_of<NonTrivial, InfoList>::value]
+                  .alignment == alignof(NonTrivial),
+              "");
+static_assert(type_info_table<InfoList>::value[0].trivially_copyable, "");
+static_assert(type_info_table<InfoList>::value[0].trivially_destructible, "");
+static_assert(not type_info_table<InfoList>::value[2].trivially_copyable, "");
+static_assert(not type_info_table<InfoList>::value[2].trivially_destructible,
+              "");
+static_assert(name_equals(type_info_table<InfoList>::value[0].name,
+                          type_info_table<InfoList>::value[0].name_size,
+                          "char"),
+              "");
+static_assert(name_equals(type_info_table<InfoList>::value[1].name,
+                          type_info_table<InfoList>::value[1].name_size,
+                          "double"),
+              "");
+static_assert(name_equals(type_info_table<other_list<unsigned int> >::value[0].name,
+                          type_info_table<other_list<unsigned int> >::value[0].name_size,
+                          "unsigned int"),
+              "");
 // clang-format on
 
-int main() { return 0; }
+template <class List> size_t total_size() {
+  size_t size = 0;
+  for (const type_info_entry &e : type_info_table<List>{})
+    size += e.size;
+  return size;
+}
+
+int main() {
+  return total_size<TypeList<> >() == 0 &&
+                 total_size<InfoList>() ==
+                     sizeof(char) + sizeof(double) + sizeof(NonTrivial)
+             ? 0
+             : 1;
+}